@@ -0,0 +1,97 @@
+#!/bin/bash
+#
+# Compile-time benchmark for flowc.
+# Generates a synthetic flow with N nodes and reports the time spent in each compilation phase.
+#
+# bench-compile.sh [-f FLOWC] [-s tree|chain] [-k] N [FLOWC-OPTIONS...]
+#
+#   -f FLOWC    flowc executable to use (default is ./flowc, or flowc from the path)
+#   -s tree     each node uses the output of two other nodes, making a graph with log2(N) stages (default)
+#   -s chain    each node uses the output of the next two nodes, making a graph with N stages
+#   -k          keep the generated files
+#
+# Any extra options are passed to flowc, e.g. --server to include code generation in the report.
+#
+bench_FLOWC=./flowc
+[ -x "$bench_FLOWC" ] || bench_FLOWC=flowc
+bench_SHAPE=tree
+bench_KEEP=0
+while [ $# -gt 0 ]
+do
+case "$1" in
+    -f)
+    bench_FLOWC="$2"
+    shift; shift
+    ;;
+    -s)
+    bench_SHAPE="$2"
+    shift; shift
+    ;;
+    -k)
+    bench_KEEP=1
+    shift
+    ;;
+    *)
+    break
+    ;;
+esac
+done
+
+bench_N="$1"
+shift
+if ! [[ "$bench_N" =~ ^[1-9][0-9]*$ ]] || [ "$bench_SHAPE" != "tree" -a "$bench_SHAPE" != "chain" ]
+then
+    echo "usage: $(basename "$0") [-f FLOWC] [-s tree|chain] [-k] N [FLOWC-OPTIONS...]" >&2
+    exit 1
+fi
+bench_FLOWC="$(cd "$(dirname "$bench_FLOWC")" 2>/dev/null && pwd)/$(basename "$bench_FLOWC")"
+[ -x "$bench_FLOWC" ] || bench_FLOWC="$(which flowc)"
+
+bench_DIR="$(mktemp -d "${TMPDIR:-/tmp}/flowc-bench.XXXXXX")"
+[ $bench_KEEP -eq 0 ] && trap 'rm -rf "$bench_DIR"' EXIT
+
+cat > "$bench_DIR/bench.proto" <<EOF
+syntax = "proto3";
+package Bench;
+
+message Value {
+    int64 a = 1;
+    int64 b = 2;
+}
+service Bench {
+    rpc Step(Value) returns (Value) {}
+    rpc Run(Value) returns (Value) {}
+}
+EOF
+
+# Print the reference to the output field of node I, or to the input if I is out of range
+node_ref() {
+    if [ "$1" -lt "$bench_N" ]
+    then
+        echo "n$1@$2"
+    else
+        echo "input@$2"
+    fi
+}
+
+{
+    echo 'import "bench.proto";'
+    for ((i = 0; i < bench_N; ++i))
+    do
+        if [ "$bench_SHAPE" == "tree" ]
+        then
+            l=$((2 * i + 1)); r=$((2 * i + 2))
+        else
+            l=$((i + 1)); r=$((i + 2))
+        fi
+        echo "node n$i {"
+        echo "    output Step(a: $(node_ref $l a), b: $(node_ref $r b));"
+        echo "}"
+    done
+    echo "entry Run {"
+    echo "    return (a: n0@a, b: n0@b);"
+    echo "}"
+} > "$bench_DIR/bench.flow"
+
+echo "$bench_N nodes ($bench_SHAPE) in $bench_DIR" >&2
+cd "$bench_DIR" && "$bench_FLOWC" --print-phase-times "$@" bench.flow
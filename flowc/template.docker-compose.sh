@@ -12,7 +12,7 @@ export docker_COMPOSE_PROJECT_NAME={{NAME}}
 }O}
 {O:MAIN_EP_ENVIRONMENT_NAME{export {{MAIN_EP_ENVIRONMENT_NAME}}_DN={{MAIN_DN_ENVIRONMENT_VALUE}}
 }O}
-{N:NODE_NAME{export scale_{{NODE_UPPERID}}={{NODE_SCALE}}
+{N:NODE_NAME{export scale_{{NODE_UPPERID}}=${{{NAME_UPPERID}}_{{NODE_UPPERID}}_SCALE-{{NODE_SCALE}}}
 }N}
 export use_COMPOSE=
 export use_SWARM="#"